@@ -30,30 +30,25 @@ void Image::Read(std::istream &input) {
     width = info_header[4] + (info_header[5] << 8) + (info_header[6] << 16) + (info_header[7] << 24);
     height = info_header[8] + (info_header[9] << 8) + (info_header[10] << 16) + (info_header[11] << 24);
     padding = (4 - width * 3 % 4) % 4;
-    unsigned char buffer[3] = {0, 0, 0};
     pixels.assign(height, std::vector<RGB>(width));
+    // Pull the whole pixel array in one read instead of a read per pixel, then decode from memory.
+    const size_t row_size = 3 * width + padding;
+    std::vector<unsigned char> data(row_size * height);
+    input.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size()));
+    if (static_cast<size_t>(input.gcount()) != data.size()) {
+        std::cout << "Invalid input file\n";
+        exit(0);
+    }
     for (size_t i = 0; i < height; ++i) {
+        const unsigned char *row = data.data() + i * row_size;
+        std::vector<RGB> &line = pixels[height - 1 - i];
         for (size_t j = 0; j < width; ++j) {
-            try {
-                input.read(reinterpret_cast<char *>(&buffer), sizeof(buffer));
-            } catch (const std::exception &e) {
-                std::cout << "Invalid input file\n";
-                exit(0);
-            }
-            pixels[i][j] = RGB(buffer[2], buffer[1], buffer[0]);
-        }
-        try {
-            input.seekg(static_cast<int>(padding), std::ios_base::cur);
-        } catch (const std::exception &e) {
-            std::cout << "Invalid input file\n";
-            exit(0);
+            line[j] = RGB(row[3 * j + 2], row[3 * j + 1], row[3 * j]);
         }
     }
-    std::reverse(pixels.begin(), pixels.end());
 }
 
 void Image::Write(std::ostream &output) {
-    std::reverse(pixels.begin(), pixels.end());
     padding = (4 - width * 3 % 4) % 4;
     const int file_size = HEADER_SIZE + INFO_HEADER_SIZE + (3 * width + padding) * height;
     unsigned char header[HEADER_SIZE];
@@ -80,18 +75,19 @@ void Image::Write(std::ostream &output) {
     info_header[HEADER_SIZE] = 24;
     output.write(reinterpret_cast<char *>(header), HEADER_SIZE);
     output.write(reinterpret_cast<char *>(info_header), INFO_HEADER_SIZE);
-    unsigned char pass[3] = {0, 0, 0};
+    // Encode every row into one buffer and hand it to the stream with a single write.
+    const size_t row_size = 3 * width + padding;
+    std::vector<char> data(row_size * height, 0);
     for (size_t i = 0; i < height; ++i) {
+        char *row = data.data() + i * row_size;
+        const std::vector<RGB> &line = pixels[height - 1 - i];
         for (size_t j = 0; j < width; ++j) {
-            unsigned char buffer[3] = {0, 0, 0};
-            RGB cur_pix = pixels[i][j];
-            buffer[0] = static_cast<unsigned char>(std::round(cur_pix.B * 255));
-            buffer[1] = static_cast<unsigned char>(std::round(cur_pix.G * 255));
-            buffer[2] = static_cast<unsigned char>(std::round(cur_pix.R * 255));
-            output.write(reinterpret_cast<char *>(buffer), 3);
+            row[3 * j] = static_cast<unsigned char>(std::round(line[j].B * 255));
+            row[3 * j + 1] = static_cast<unsigned char>(std::round(line[j].G * 255));
+            row[3 * j + 2] = static_cast<unsigned char>(std::round(line[j].R * 255));
         }
-        output.write(reinterpret_cast<char *>(pass), padding);
     }
+    output.write(data.data(), static_cast<std::streamsize>(data.size()));
 }
 
 size_t Image::GetHeight() const {